@@ -6,6 +6,8 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/Controller.h"
+#include "GameFramework/InputSettings.h"
+#include "GameFramework/PlayerController.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
@@ -144,7 +146,7 @@ void ASkateCharacter::Move(const FInputActionValue& Value)
 		if (GetVelocity().SquaredLength() <= 0.0f)
 			return;
 
-		GetCharacterMovement()->AddForce(-GetVelocity() * 250.0f);
+		GetCharacterMovement()->AddForce(-GetVelocity() * BrakeForce);
 	}
 }
 
@@ -162,7 +164,21 @@ void ASkateCharacter::Turn()
 		TurnRate = 1.0f;
 	}
 	TurnRate *= GetRightInput() < 0 ? -1 : 1;
-	AddControllerYawInput(GetCharacterMovement()->RotationRate.Yaw * TurnRate * GetWorld()->GetDeltaSeconds());
+	const float YawDelta = GetCharacterMovement()->RotationRate.Yaw * TurnRate * GetWorld()->GetDeltaSeconds();
+
+	// Only player controllers accumulate yaw input, so rotate any other controller directly.
+	if (Controller && !Controller->IsPlayerController())
+	{
+		// Apply the same legacy yaw scale APlayerController::AddYawInput does, so both paths turn at the same rate.
+		const float YawScale = GetDefault<UInputSettings>()->bEnableLegacyInputScales ? GetDefault<APlayerController>()->GetDeprecatedInputYawScale() : 1.0f;
+		FRotator ControlRotation = Controller->GetControlRotation();
+		ControlRotation.Yaw += YawDelta * YawScale;
+		Controller->SetControlRotation(ControlRotation);
+	}
+	else
+	{
+		AddControllerYawInput(YawDelta);
+	}
 }
 
 void ASkateCharacter::StartPushing()
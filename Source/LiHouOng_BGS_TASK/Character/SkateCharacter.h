@@ -16,6 +16,9 @@ class LIHOUONG_BGS_TASK_API ASkateCharacter : public ACharacter
 {
 	GENERATED_BODY()
 
+	// The tuning sweep drives the skater with scripted input and overrides its handling parameters.
+	friend class USkateTuningCommandlet;
+
 private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	USpringArmComponent* CameraBoom;
@@ -130,4 +133,8 @@ private:
 	// CameraBoom's relative pitch will change between -CameraPitchRange and CameraPitchRange.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true", ClampMin = "0.0", ClampMax = "70.0"))
 	float MaxCamPitch = 45.0f;
+
+	// Scales the velocity-opposing force applied while braking.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float BrakeForce = 250.0f;
 };
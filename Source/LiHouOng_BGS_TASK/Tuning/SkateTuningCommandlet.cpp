@@ -0,0 +1,626 @@
+#include "SkateTuningCommandlet.h"
+#include "SkateTuningController.h"
+#include "Character/SkateCharacter.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "InputActionValue.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#else
+#include <time.h>
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogSkateTuning, Log, All);
+
+const TCHAR* const FSkateTuningParams::Names[FSkateTuningParams::Num] =
+{
+	TEXT("FullTurnSpeed"),
+	TEXT("MinCamPitch"),
+	TEXT("MaxCamPitch"),
+	TEXT("JumpZVelocity"),
+	TEXT("AirControl"),
+	TEXT("BrakeForce"),
+};
+
+namespace
+{
+	const TCHAR* const DefaultCharacterClassPath = TEXT("/Game/Blueprints/BP_SkateChar_Remy.BP_SkateChar_Remy_C");
+	const TCHAR* const FloorMeshPath = TEXT("/Engine/BasicShapes/Cube.Cube");
+
+	// Every run integrates with the same step so results don't depend on machine load.
+	constexpr float FixedDeltaTime = 1.0f / 60.0f;
+
+	// Horizontal speed (cm/s) below which the skater counts as stopped.
+	constexpr float StoppedSpeed = 5.0f;
+
+	// The jump phase keeps running until the skater lands, but never longer than this (s).
+	constexpr float MaxJumpDuration = 10.0f;
+
+	// Upper bound on configs per sweep, well past what a single machine gets through in a day.
+	constexpr int64 MaxConfigs = 1000000;
+
+	// Each run leaves a dead world behind, so collect them before memory piles up.
+	constexpr int32 RunsPerGarbageCollection = 32;
+
+	enum class EScriptPhase : uint8
+	{
+		Settle,
+		Accelerate,
+		Turn,
+		Jump,
+		Brake
+	};
+
+	struct FScriptStep
+	{
+		EScriptPhase Phase;
+		float Duration;
+
+		// Same layout as the Move action. Y is forward, X is right.
+		FVector2D Input;
+	};
+
+	// The fixed input sequence every parameter set is driven through. Forward input also holds Push, as W does in game.
+	const FScriptStep InputScript[] =
+	{
+		{ EScriptPhase::Settle, 0.5f, FVector2D(0.0f, 0.0f) },
+		{ EScriptPhase::Accelerate, 3.0f, FVector2D(0.0f, 1.0f) },
+		{ EScriptPhase::Turn, 2.0f, FVector2D(1.0f, 1.0f) },
+		{ EScriptPhase::Accelerate, 1.0f, FVector2D(0.0f, 1.0f) },
+		{ EScriptPhase::Jump, 2.0f, FVector2D(0.0f, 1.0f) },
+		{ EScriptPhase::Brake, 5.0f, FVector2D(0.0f, -1.0f) },
+	};
+
+	struct FParamRange
+	{
+		int32 Param;
+		float Min;
+		float Max;
+		int32 Steps;
+	};
+
+	int32 FindParam(const FString& Name)
+	{
+		for (int32 Param = 0; Param < FSkateTuningParams::Num; ++Param)
+		{
+			if (Name.Equals(FSkateTuningParams::Names[Param], ESearchCase::IgnoreCase))
+			{
+				return Param;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// Parses "Name=Min:Max:Steps,..." where Steps is optional and defaults to 2.
+	bool ParseGrid(const FString& GridSpec, TArray<FParamRange>& OutRanges)
+	{
+		TArray<FString> Entries;
+		GridSpec.ParseIntoArray(Entries, TEXT(","));
+		for (const FString& Entry : Entries)
+		{
+			FString Name, Range;
+			TArray<FString> Bounds;
+			if (!Entry.Split(TEXT("="), &Name, &Range) || Range.ParseIntoArray(Bounds, TEXT(":")) < 2 || Bounds.Num() > 3)
+			{
+				UE_LOG(LogSkateTuning, Error, TEXT("Invalid grid entry '%s', expected Name=Min:Max[:Steps]."), *Entry);
+				return false;
+			}
+
+			const int32 Param = FindParam(Name.TrimStartAndEnd());
+			if (Param == INDEX_NONE)
+			{
+				UE_LOG(LogSkateTuning, Error, TEXT("Unknown tuning parameter '%s'."), *Name);
+				return false;
+			}
+
+			FParamRange& ParamRange = OutRanges.AddDefaulted_GetRef();
+			ParamRange.Param = Param;
+			ParamRange.Min = FCString::Atof(*Bounds[0]);
+			ParamRange.Max = FCString::Atof(*Bounds[1]);
+			ParamRange.Steps = Bounds.Num() == 3 ? FMath::Max(1, FCString::Atoi(*Bounds[2])) : 2;
+		}
+		return true;
+	}
+
+	void BuildGridConfigs(const TArray<FParamRange>& Ranges, const FSkateTuningParams& Defaults, TArray<FSkateTuningParams>& OutConfigs)
+	{
+		OutConfigs = { Defaults };
+		for (const FParamRange& ParamRange : Ranges)
+		{
+			TArray<FSkateTuningParams> Expanded;
+			Expanded.Reserve(OutConfigs.Num() * ParamRange.Steps);
+			for (const FSkateTuningParams& Base : OutConfigs)
+			{
+				for (int32 Step = 0; Step < ParamRange.Steps; ++Step)
+				{
+					FSkateTuningParams& Config = Expanded.Add_GetRef(Base);
+					const float Alpha = ParamRange.Steps > 1 ? static_cast<float>(Step) / (ParamRange.Steps - 1) : 0.0f;
+					Config.Values[ParamRange.Param] = FMath::Lerp(ParamRange.Min, ParamRange.Max, Alpha);
+				}
+			}
+			OutConfigs = MoveTemp(Expanded);
+		}
+	}
+
+	void BuildRandomConfigs(const TArray<FParamRange>& Ranges, const FSkateTuningParams& Defaults, int32 NumSamples, int32 Seed, TArray<FSkateTuningParams>& OutConfigs)
+	{
+		FRandomStream Stream(Seed);
+		OutConfigs.Reset(NumSamples);
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			FSkateTuningParams& Config = OutConfigs.Add_GetRef(Defaults);
+			for (const FParamRange& ParamRange : Ranges)
+			{
+				Config.Values[ParamRange.Param] = FMath::Lerp(ParamRange.Min, ParamRange.Max, Stream.GetFraction());
+			}
+		}
+	}
+
+	FString MakeParamsHeader()
+	{
+		FString Header = TEXT("Index");
+		for (const TCHAR* Name : FSkateTuningParams::Names)
+		{
+			Header += TEXT(",");
+			Header += Name;
+		}
+		return Header;
+	}
+
+	FString MakeParamsRow(int32 Index, const FSkateTuningParams& Params)
+	{
+		FString Row = FString::FromInt(Index);
+		for (float Value : Params.Values)
+		{
+			Row += FString::Printf(TEXT(",%g"), Value);
+		}
+		return Row;
+	}
+
+	bool ParseParamsRow(const FString& Row, int32& OutIndex, FSkateTuningParams& OutParams)
+	{
+		TArray<FString> Fields;
+		if (Row.ParseIntoArray(Fields, TEXT(","), false) != FSkateTuningParams::Num + 1)
+		{
+			return false;
+		}
+
+		OutIndex = FCString::Atoi(*Fields[0]);
+		for (int32 Param = 0; Param < FSkateTuningParams::Num; ++Param)
+		{
+			OutParams.Values[Param] = FCString::Atof(*Fields[Param + 1]);
+		}
+		return true;
+	}
+
+	// CPU time of the whole process, so physics and animation work on task graph threads is counted too.
+	double GetProcessCpuSeconds()
+	{
+#if PLATFORM_WINDOWS
+		FILETIME CreationTime, ExitTime, KernelTime, UserTime;
+		::GetProcessTimes(::GetCurrentProcess(), &CreationTime, &ExitTime, &KernelTime, &UserTime);
+		const uint64 Ticks = ((uint64)KernelTime.dwHighDateTime << 32 | KernelTime.dwLowDateTime)
+			+ ((uint64)UserTime.dwHighDateTime << 32 | UserTime.dwLowDateTime);
+		return Ticks * 100e-9;
+#else
+		struct timespec CpuTime;
+		clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &CpuTime);
+		return CpuTime.tv_sec + CpuTime.tv_nsec * 1e-9;
+#endif
+	}
+
+	const TCHAR* const ResultsHeaderSuffix = TEXT(",TopSpeed,TurnRadius,StopDistance,Airtime,CpuMs");
+}
+
+USkateTuningCommandlet::USkateTuningCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 USkateTuningCommandlet::Main(const FString& Params)
+{
+	FString CharacterClassPath = DefaultCharacterClassPath;
+	FParse::Value(*Params, TEXT("CharacterClass="), CharacterClassPath);
+	const TSubclassOf<ASkateCharacter> CharacterClass = LoadClass<ASkateCharacter>(nullptr, *CharacterClassPath);
+	if (!CharacterClass)
+	{
+		UE_LOG(LogSkateTuning, Error, TEXT("Failed to load skater class '%s'."), *CharacterClassPath);
+		return 1;
+	}
+
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("SkateTuning/Sweep.csv");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
+
+	if (FParse::Param(*Params, TEXT("Worker")))
+	{
+		FString ConfigsPath;
+		int32 ShardIndex = 0;
+		int32 ShardCount = 1;
+		FParse::Value(*Params, TEXT("Configs="), ConfigsPath);
+		FParse::Value(*Params, TEXT("ShardIndex="), ShardIndex);
+		FParse::Value(*Params, TEXT("ShardCount="), ShardCount);
+		return RunWorker(ConfigsPath, OutputPath, ShardIndex, FMath::Max(1, ShardCount), CharacterClass);
+	}
+
+	FString GridSpec;
+	int32 NumSamples = 0;
+	int32 Seed = 0;
+	int32 NumWorkers = FPlatformMisc::NumberOfCores();
+	FParse::Value(*Params, TEXT("Grid="), GridSpec, false);
+	FParse::Value(*Params, TEXT("Samples="), NumSamples);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("Workers="), NumWorkers);
+
+	TArray<FParamRange> Ranges;
+	if (!ParseGrid(GridSpec, Ranges))
+	{
+		return 1;
+	}
+
+	// Check the size before expanding, the grid is a Cartesian product and grows fast.
+	int64 NumConfigs = 1;
+	for (const FParamRange& ParamRange : Ranges)
+	{
+		NumConfigs = FMath::Min(NumConfigs * ParamRange.Steps, MaxConfigs + 1);
+	}
+	if (NumSamples > 0)
+	{
+		NumConfigs = NumSamples;
+	}
+	if (NumConfigs > MaxConfigs)
+	{
+		UE_LOG(LogSkateTuning, Error, TEXT("The sweep would run more than %lld configs, reduce -Grid steps or -Samples."), MaxConfigs);
+		return 1;
+	}
+
+	TArray<FSkateTuningParams> Configs;
+	if (NumSamples > 0)
+	{
+		BuildRandomConfigs(Ranges, GetDefaultParams(CharacterClass), NumSamples, Seed, Configs);
+	}
+	else
+	{
+		BuildGridConfigs(Ranges, GetDefaultParams(CharacterClass), Configs);
+	}
+
+	TArray<FString> ConfigLines;
+	ConfigLines.Reserve(Configs.Num() + 1);
+	ConfigLines.Add(MakeParamsHeader());
+	for (int32 Index = 0; Index < Configs.Num(); ++Index)
+	{
+		ConfigLines.Add(MakeParamsRow(Index, Configs[Index]));
+	}
+
+	// Intermediate files sit next to the output, so concurrent sweeps with different outputs don't collide.
+	const FString ConfigsPath = OutputPath + TEXT(".configs.csv");
+	if (!FFileHelper::SaveStringArrayToFile(ConfigLines, *ConfigsPath))
+	{
+		UE_LOG(LogSkateTuning, Error, TEXT("Failed to write '%s'."), *ConfigsPath);
+		return 1;
+	}
+
+	NumWorkers = FMath::Clamp(NumWorkers, 1, Configs.Num());
+	UE_LOG(LogSkateTuning, Display, TEXT("Sweeping %d configs across %d workers."), Configs.Num(), NumWorkers);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 ReturnCode = NumWorkers == 1
+		? RunWorker(ConfigsPath, OutputPath, 0, 1, CharacterClass)
+		: RunCoordinator(ConfigsPath, OutputPath, Configs.Num(), NumWorkers, CharacterClassPath);
+
+	if (ReturnCode == 0)
+	{
+		IFileManager::Get().Delete(*ConfigsPath);
+		UE_LOG(LogSkateTuning, Display, TEXT("Wrote '%s' in %.1fs."), *OutputPath, FPlatformTime::Seconds() - StartTime);
+	}
+	return ReturnCode;
+}
+
+int32 USkateTuningCommandlet::RunCoordinator(const FString& ConfigsPath, const FString& OutputPath, int32 NumConfigs, int32 NumWorkers, const FString& CharacterClassPath) const
+{
+	// Worlds tick on the game thread, so each core gets its own process rather than a thread.
+	const FString Executable = FPlatformProcess::ExecutablePath();
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+	TArray<FProcHandle> Workers;
+	TArray<FString> ShardPaths;
+	bool bSucceeded = true;
+	for (int32 ShardIndex = 0; ShardIndex < NumWorkers; ++ShardIndex)
+	{
+		const FString& ShardPath = ShardPaths.Add_GetRef(OutputPath + FString::Printf(TEXT(".shard_%d.csv"), ShardIndex));
+
+		// Workers run hidden, so each one logs to a file next to its shard for diagnosing failures.
+		// -Multiprocess keeps concurrent instances from fighting over shared Saved/ state such as config and DDC writes.
+		const FString Args = FString::Printf(
+			TEXT("\"%s\" -run=SkateTuning -Worker -ShardIndex=%d -ShardCount=%d -Configs=\"%s\" -Output=\"%s\" -CharacterClass=\"%s\" -abslog=\"%s.log\" -Multiprocess -unattended -nullrhi -nosplash -nosound -nopause"),
+			*ProjectPath, ShardIndex, NumWorkers, *ConfigsPath, *ShardPath, *CharacterClassPath, *ShardPath);
+
+		FProcHandle Worker = FPlatformProcess::CreateProc(*Executable, *Args, false, true, true, nullptr, 0, nullptr, nullptr);
+		if (!Worker.IsValid())
+		{
+			UE_LOG(LogSkateTuning, Error, TEXT("Failed to launch worker %d."), ShardIndex);
+			bSucceeded = false;
+			break;
+		}
+		Workers.Add(Worker);
+	}
+
+	for (int32 ShardIndex = 0; ShardIndex < Workers.Num(); ++ShardIndex)
+	{
+		FPlatformProcess::WaitForProc(Workers[ShardIndex]);
+		int32 WorkerReturnCode = 0;
+		FPlatformProcess::GetProcReturnCode(Workers[ShardIndex], &WorkerReturnCode);
+		FPlatformProcess::CloseProc(Workers[ShardIndex]);
+		const FString LogPath = ShardPaths[ShardIndex] + TEXT(".log");
+		if (WorkerReturnCode != 0)
+		{
+			UE_LOG(LogSkateTuning, Error, TEXT("Worker %d exited with code %d, see '%s'."), ShardIndex, WorkerReturnCode, *LogPath);
+			bSucceeded = false;
+		}
+		else
+		{
+			IFileManager::Get().Delete(*LogPath);
+		}
+	}
+
+	if (!bSucceeded)
+	{
+		return 1;
+	}
+
+	TArray<TPair<int32, FString>> Rows;
+	Rows.Reserve(NumConfigs);
+	for (const FString& ShardPath : ShardPaths)
+	{
+		TArray<FString> ShardLines;
+		if (!FFileHelper::LoadFileToStringArray(ShardLines, *ShardPath))
+		{
+			UE_LOG(LogSkateTuning, Error, TEXT("Failed to read '%s'."), *ShardPath);
+			return 1;
+		}
+
+		// Skip the header, every shard writes its own.
+		for (int32 LineIndex = 1; LineIndex < ShardLines.Num(); ++LineIndex)
+		{
+			Rows.Emplace(FCString::Atoi(*ShardLines[LineIndex]), MoveTemp(ShardLines[LineIndex]));
+		}
+		IFileManager::Get().Delete(*ShardPath);
+	}
+
+	if (Rows.Num() != NumConfigs)
+	{
+		UE_LOG(LogSkateTuning, Warning, TEXT("Expected %d results but the workers produced %d."), NumConfigs, Rows.Num());
+	}
+
+	Rows.Sort([](const TPair<int32, FString>& A, const TPair<int32, FString>& B) { return A.Key < B.Key; });
+
+	TArray<FString> OutputLines;
+	OutputLines.Reserve(Rows.Num() + 1);
+	OutputLines.Add(MakeParamsHeader() + ResultsHeaderSuffix);
+	for (TPair<int32, FString>& Row : Rows)
+	{
+		OutputLines.Add(MoveTemp(Row.Value));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(OutputLines, *OutputPath))
+	{
+		UE_LOG(LogSkateTuning, Error, TEXT("Failed to write '%s'."), *OutputPath);
+		return 1;
+	}
+	return 0;
+}
+
+int32 USkateTuningCommandlet::RunWorker(const FString& ConfigsPath, const FString& OutputPath, int32 ShardIndex, int32 ShardCount, TSubclassOf<ASkateCharacter> CharacterClass) const
+{
+	TArray<FString> ConfigLines;
+	if (!FFileHelper::LoadFileToStringArray(ConfigLines, *ConfigsPath))
+	{
+		UE_LOG(LogSkateTuning, Error, TEXT("Failed to read '%s'."), *ConfigsPath);
+		return 1;
+	}
+
+	TArray<FString> OutputLines;
+	OutputLines.Add(MakeParamsHeader() + ResultsHeaderSuffix);
+
+	int32 NumRuns = 0;
+	for (int32 LineIndex = 1; LineIndex < ConfigLines.Num(); ++LineIndex)
+	{
+		int32 Index;
+		FSkateTuningParams Params;
+		if (!ParseParamsRow(ConfigLines[LineIndex], Index, Params))
+		{
+			UE_LOG(LogSkateTuning, Error, TEXT("Malformed config line %d in '%s'."), LineIndex, *ConfigsPath);
+			return 1;
+		}
+
+		if (Index % ShardCount != ShardIndex)
+		{
+			continue;
+		}
+
+		const FSkateTuningResult Result = RunScenario(CharacterClass, Params);
+		OutputLines.Add(MakeParamsRow(Index, Params) + FString::Printf(TEXT(",%.2f,%.2f,%.2f,%.3f,%.3f"),
+			Result.TopSpeed, Result.TurnRadius, Result.StopDistance, Result.Airtime, Result.CpuMs));
+
+		if (++NumRuns % RunsPerGarbageCollection == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(OutputLines, *OutputPath))
+	{
+		UE_LOG(LogSkateTuning, Error, TEXT("Failed to write '%s'."), *OutputPath);
+		return 1;
+	}
+	return 0;
+}
+
+FSkateTuningParams USkateTuningCommandlet::GetDefaultParams(TSubclassOf<ASkateCharacter> CharacterClass)
+{
+	const ASkateCharacter* Defaults = CharacterClass->GetDefaultObject<ASkateCharacter>();
+
+	FSkateTuningParams Params;
+	Params.Values[FSkateTuningParams::FullTurnSpeed] = Defaults->FullTurnSpeed;
+	Params.Values[FSkateTuningParams::MinCamPitch] = Defaults->MinCamPitch;
+	Params.Values[FSkateTuningParams::MaxCamPitch] = Defaults->MaxCamPitch;
+	Params.Values[FSkateTuningParams::JumpZVelocity] = Defaults->GetCharacterMovement()->JumpZVelocity;
+	Params.Values[FSkateTuningParams::AirControl] = Defaults->GetCharacterMovement()->AirControl;
+	Params.Values[FSkateTuningParams::BrakeForce] = Defaults->BrakeForce;
+	return Params;
+}
+
+void USkateTuningCommandlet::ApplyParams(ASkateCharacter* Skater, const FSkateTuningParams& Params)
+{
+	Skater->FullTurnSpeed = Params.Values[FSkateTuningParams::FullTurnSpeed];
+	Skater->MinCamPitch = Params.Values[FSkateTuningParams::MinCamPitch];
+	Skater->MaxCamPitch = Params.Values[FSkateTuningParams::MaxCamPitch];
+	Skater->GetCharacterMovement()->JumpZVelocity = Params.Values[FSkateTuningParams::JumpZVelocity];
+	Skater->GetCharacterMovement()->AirControl = Params.Values[FSkateTuningParams::AirControl];
+	Skater->BrakeForce = Params.Values[FSkateTuningParams::BrakeForce];
+}
+
+FSkateTuningResult USkateTuningCommandlet::RunScenario(TSubclassOf<ASkateCharacter> CharacterClass, const FSkateTuningParams& Params)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("SkateTuningWorld"), nullptr, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+
+	// Flat ground, large enough that the script never runs off the edge.
+	const FTransform FloorTransform(FRotator::ZeroRotator, FVector(0.0f, 0.0f, -50.0f), FVector(4000.0f, 4000.0f, 1.0f));
+	AStaticMeshActor* Floor = World->SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(), FloorTransform);
+	Floor->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, FloorMeshPath));
+	Floor->FinishSpawning(FloorTransform);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ASkateCharacter* Skater = World->SpawnActor<ASkateCharacter>(CharacterClass, FVector(0.0f, 0.0f, 150.0f), FRotator::ZeroRotator, SpawnParams);
+	ASkateTuningController* Controller = World->SpawnActor<ASkateTuningController>();
+	Controller->Possess(Skater);
+	ApplyParams(Skater, Params);
+
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	FSkateTuningResult Result;
+	float TurnArcLength = 0.0f;
+	float TurnHeadingChange = 0.0f;
+	float BrakeDistance = 0.0f;
+
+	// Push shares the forward key with Move, so it is Started when forward input begins and Completed when it ends.
+	bool bPushHeld = false;
+
+	const double StartCpuSeconds = GetProcessCpuSeconds();
+	for (const FScriptStep& Step : InputScript)
+	{
+		const bool bPushPressed = Step.Input.Y > 0.0f;
+		if (bPushPressed && !bPushHeld)
+		{
+			Skater->StartPushing();
+		}
+		else if (!bPushPressed && bPushHeld)
+		{
+			Skater->StopPushing();
+		}
+		bPushHeld = bPushPressed;
+
+		if (Step.Phase == EScriptPhase::Jump)
+		{
+			Skater->Jump();
+		}
+		else if (Step.Phase == EScriptPhase::Brake)
+		{
+			Skater->StartBraking();
+		}
+
+		// Count whole frames so accumulated float error can't add or drop a tick.
+		const int32 NumFrames = FMath::RoundToInt(Step.Duration / FixedDeltaTime);
+
+		// Past its duration the jump phase keeps ticking until landing, so airtime isn't cut short and braking doesn't start mid-air.
+		const int32 MaxFrames = Step.Phase == EScriptPhase::Jump ? FMath::RoundToInt(MaxJumpDuration / FixedDeltaTime) : NumFrames;
+		for (int32 Frame = 0; Frame < MaxFrames; ++Frame)
+		{
+			if (Frame >= NumFrames && !Skater->GetCharacterMovement()->IsFalling())
+			{
+				break;
+			}
+
+			const FVector PrevLocation = Skater->GetActorLocation();
+			const FVector PrevVelocity = Skater->GetVelocity();
+
+			// Move is bound to ETriggerEvent::Triggered, so the input is fed again every frame.
+			if (!Step.Input.IsZero())
+			{
+				Skater->Move(FInputActionValue(Step.Input));
+			}
+			World->Tick(LEVELTICK_All, FixedDeltaTime);
+
+			const FVector Velocity = Skater->GetVelocity();
+			const float Speed = Velocity.Size2D();
+			const float Distance = FVector::Dist2D(PrevLocation, Skater->GetActorLocation());
+			Result.TopSpeed = FMath::Max(Result.TopSpeed, Speed);
+
+			if (Step.Phase == EScriptPhase::Turn && Speed > StoppedSpeed && PrevVelocity.Size2D() > StoppedSpeed)
+			{
+				TurnArcLength += Distance;
+				TurnHeadingChange += FMath::FindDeltaAngleRadians(PrevVelocity.HeadingAngle(), Velocity.HeadingAngle());
+			}
+			else if (Step.Phase == EScriptPhase::Jump && Skater->GetCharacterMovement()->IsFalling())
+			{
+				Result.Airtime += FixedDeltaTime;
+			}
+			else if (Step.Phase == EScriptPhase::Brake)
+			{
+				BrakeDistance += Distance;
+				if (Speed < StoppedSpeed)
+				{
+					Result.StopDistance = BrakeDistance;
+					break;
+				}
+			}
+		}
+
+		if (Step.Phase == EScriptPhase::Jump)
+		{
+			if (Skater->GetCharacterMovement()->IsFalling())
+			{
+				Result.Airtime = -1.0f;
+			}
+			Skater->StopJumping();
+		}
+		else if (Step.Phase == EScriptPhase::Brake)
+		{
+			Skater->StopBraking();
+		}
+	}
+
+	if (bPushHeld)
+	{
+		Skater->StopPushing();
+	}
+	Result.CpuMs = (GetProcessCpuSeconds() - StartCpuSeconds) * 1000.0;
+
+	if (FMath::Abs(TurnHeadingChange) > KINDA_SMALL_NUMBER)
+	{
+		Result.TurnRadius = TurnArcLength / FMath::Abs(TurnHeadingChange);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return Result;
+}
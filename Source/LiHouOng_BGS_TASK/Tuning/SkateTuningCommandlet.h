@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Templates/SubclassOf.h"
+#include "SkateTuningCommandlet.generated.h"
+
+class ASkateCharacter;
+
+// One point in the sweep. Values are indexed by ESkateTuningParam.
+struct FSkateTuningParams
+{
+	enum ESkateTuningParam
+	{
+		FullTurnSpeed,
+		MinCamPitch,
+		MaxCamPitch,
+		JumpZVelocity,
+		AirControl,
+		BrakeForce,
+		Num
+	};
+
+	static const TCHAR* const Names[Num];
+
+	float Values[Num] = {};
+};
+
+// Outcome of driving one parameter set through the input script.
+struct FSkateTuningResult
+{
+	// Highest horizontal speed reached (cm/s).
+	float TopSpeed = 0.0f;
+
+	// Average radius over the turning segment (cm). -1 if the skater did not change heading.
+	float TurnRadius = -1.0f;
+
+	// Distance covered from the start of braking until the skater stopped (cm). -1 if it was still moving when the brake segment ran out.
+	float StopDistance = -1.0f;
+
+	// Time spent airborne after the jump (s). -1 if the skater had not landed when the jump segment hit its time cap.
+	float Airtime = 0.0f;
+
+	// Process CPU time spent on the run itself, excluding world setup. Includes task graph threads used by physics and animation.
+	double CpuMs = 0.0;
+};
+
+/**
+ * Headless sweep over the skater's handling parameters.
+ *
+ * Every parameter set is simulated in its own throwaway game world with a fixed scripted input sequence
+ * (accelerate, turn, jump, brake). The sets are sharded across worker processes, one per CPU core, and the
+ * per-run metrics are merged into a single CSV table.
+ *
+ * UnrealEditor-Cmd LiHouOng_BGS_TASK.uproject -run=SkateTuning -Grid="FullTurnSpeed=200:600:5,BrakeForce=100:400:4" -Output=Sweep.csv
+ *
+ * -Grid=     Comma separated Name=Min:Max[:Steps] ranges, Steps defaults to 2. Parameters left out keep the character's defaults.
+ *            Names: FullTurnSpeed, MinCamPitch, MaxCamPitch, JumpZVelocity, AirControl, BrakeForce.
+ *            MinCamPitch and MaxCamPitch only move the camera boom and have no measured outcome, so sweeping them
+ *            just repeats rows that differ in those columns alone.
+ * -Samples=  Draw this many random sets from the -Grid ranges instead of the full grid (Steps is ignored).
+ * -Seed=     Random seed for -Samples.
+ * -Workers=  Number of worker processes. Defaults to the number of physical cores; 1 runs in-process.
+ * -CharacterClass=  Skater class to simulate. Defaults to the Remy blueprint.
+ */
+UCLASS()
+class USkateTuningCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USkateTuningCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	// Splits the configs across worker processes and merges their results into OutputPath.
+	int32 RunCoordinator(const FString& ConfigsPath, const FString& OutputPath, int32 NumConfigs, int32 NumWorkers, const FString& CharacterClassPath) const;
+
+	// Simulates every config whose index modulo ShardCount is ShardIndex and writes the results to OutputPath.
+	int32 RunWorker(const FString& ConfigsPath, const FString& OutputPath, int32 ShardIndex, int32 ShardCount, TSubclassOf<ASkateCharacter> CharacterClass) const;
+
+	// Reads the tunable values from the class defaults, used for parameters the sweep does not vary.
+	static FSkateTuningParams GetDefaultParams(TSubclassOf<ASkateCharacter> CharacterClass);
+
+	static void ApplyParams(ASkateCharacter* Skater, const FSkateTuningParams& Params);
+
+	// Spawns a fresh world, drives one skater through the input script and measures the outcome.
+	static FSkateTuningResult RunScenario(TSubclassOf<ASkateCharacter> CharacterClass, const FSkateTuningParams& Params);
+};
@@ -0,0 +1,18 @@
+#include "SkateTuningController.h"
+#include "GameFramework/Pawn.h"
+
+ASkateTuningController::ASkateTuningController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+void ASkateTuningController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// A player controller does this in UpdateRotation. Without it the pawn's yaw would never follow the control rotation.
+	if (APawn* ControlledPawn = GetPawn())
+	{
+		ControlledPawn->FaceRotation(GetControlRotation(), DeltaSeconds);
+	}
+}
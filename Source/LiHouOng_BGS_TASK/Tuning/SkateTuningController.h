@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Controller.h"
+#include "SkateTuningController.generated.h"
+
+// Bare controller used to possess the skater in headless tuning worlds, where there is no local player.
+UCLASS(NotBlueprintable, NotPlaceable, Transient)
+class LIHOUONG_BGS_TASK_API ASkateTuningController : public AController
+{
+	GENERATED_BODY()
+
+public:
+	ASkateTuningController();
+
+	virtual void Tick(float DeltaSeconds) override;
+};